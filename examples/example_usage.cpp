@@ -1,16 +1,20 @@
 #include <ecpp/bitfield_set.hpp>
+#include <ecpp/register_bitfield.hpp>
 
 using namespace ecpp;
 
 struct xPSR {
-  static inline auto address = reinterpret_cast<uint32_t volatile *>(0x20000);
-
-  static inline auto ISR = as_writable_bitfield<unsigned, 0x0000'FFFFU>(*address);
-  static inline auto T = as_writable_bitfield<bool, 0x0100'0000U>(*address);
-  static inline auto V = as_writable_bitfield<bool, 0x1000'0000U>(*address);
-  static inline auto C = as_writable_bitfield<bool, 0x2000'0000U>(*address);
-  static inline auto Z = as_writable_bitfield<bool, 0x4000'0000U>(*address);
-  static inline auto N = as_writable_bitfield<bool, 0x8000'0000U>(*address);
+  static constexpr std::uintptr_t address = 0x20000;
+
+  template <typename FieldType, std::uint32_t Mask>
+  using field = register_bitfield<uint32_t volatile, address, bitfield_spec<FieldType, Mask>>;
+
+  static constexpr field<unsigned, 0x0000'FFFFU> ISR{};
+  static constexpr field<bool, 0x0100'0000U> T{};
+  static constexpr field<bool, 0x1000'0000U> V{};
+  static constexpr field<bool, 0x2000'0000U> C{};
+  static constexpr field<bool, 0x4000'0000U> Z{};
+  static constexpr field<bool, 0x8000'0000U> N{};
 };
 
 int main() {
@@ -0,0 +1,154 @@
+#ifndef ECPP_BITFIELD_ALGORITHM_HPP_
+#define ECPP_BITFIELD_ALGORITHM_HPP_
+
+#include <ecpp/bitfield_view.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+
+namespace ecpp {
+
+/// @brief Single field change reported by diff()
+struct field_change {
+  std::size_t index; ///< Position of the changed word within the storage range
+  std::size_t field; ///< Position of the changed field within the Fields pack
+
+  constexpr bool operator==(field_change const &) const noexcept = default;
+};
+
+namespace bf_impl {
+/// @brief Number of storage words processed at once. Covers a single 64-byte cache line
+template <typename T>
+inline constexpr std::size_t words_per_block = std::max<std::size_t>(64 / sizeof(T), 1);
+
+template <typename T, is_bitfield_spec... Fields, typename OutputIt, std::size_t... I>
+constexpr OutputIt emit_changes(std::size_t index, T changed, OutputIt out,
+                                std::index_sequence<I...>) {
+  (..., (static_cast<T>(changed & static_cast<T>(Fields::mask)) != 0
+              ? void(*out++ = field_change{index, I})
+              : void()));
+  return out;
+}
+
+template <typename Range>
+concept storage_range = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                        std::unsigned_integral<std::ranges::range_value_t<Range>>;
+} // namespace bf_impl
+
+/**
+ * Reports fields that differ between two snapshots of the same storage range
+ *
+ * Words are compared a cache line at a time; blocks without any change in the fields' bits are
+ * skipped without inspecting individual fields. The comparison loop is kept rolled, so the
+ * compiler can vectorize it. For each changed field, a field_change is written to out, ordered by word
+ * index and then by position of the field in the Fields pack. Only the common prefix of both
+ * ranges is compared.
+ *
+ * @param previous Older snapshot
+ * @param current Newer snapshot
+ * @param out Destination of reported changes
+ * @return Output iterator past the last reported change
+ */
+template <is_bitfield_spec... Fields, bf_impl::storage_range PreviousRange,
+          bf_impl::storage_range CurrentRange, std::output_iterator<field_change> OutputIt>
+  requires(std::same_as<std::ranges::range_value_t<PreviousRange>,
+                        std::ranges::range_value_t<CurrentRange>> &&
+           bf_impl::non_overlaping<Fields::mask...> &&
+           fits_in<(... | Fields::mask), std::ranges::range_value_t<PreviousRange>>)
+constexpr OutputIt diff(PreviousRange const &previous, CurrentRange const &current,
+                        OutputIt out) {
+  using storage_type = std::ranges::range_value_t<PreviousRange>;
+  constexpr auto mask = static_cast<storage_type>((... | Fields::mask));
+  constexpr auto block = bf_impl::words_per_block<storage_type>;
+
+  std::span<storage_type const> p{std::ranges::data(previous), std::ranges::size(previous)};
+  std::span<storage_type const> c{std::ranges::data(current), std::ranges::size(current)};
+  auto const size = std::min(p.size(), c.size());
+
+  auto report = [&](std::size_t index) {
+    auto changed = static_cast<storage_type>(static_cast<storage_type>(p[index] ^ c[index]) & mask);
+    if(changed != 0) {
+      out = bf_impl::emit_changes<storage_type, Fields...>(index, changed, out,
+                                                           std::index_sequence_for<Fields...>{});
+    }
+  };
+
+  std::size_t i = 0;
+  for(; i + block <= size; i += block) {
+    storage_type acc = 0;
+    // Complete unrolling at -O3 prevents GCC from vectorizing the reduction
+#pragma GCC unroll 1
+    for(std::size_t j = 0; j < block; ++j) {
+      acc |= static_cast<storage_type>(p[i + j] ^ c[i + j]);
+    }
+    if(static_cast<storage_type>(acc & mask) == 0) {
+      continue;
+    }
+    for(std::size_t j = 0; j < block; ++j) {
+      report(i + j);
+    }
+  }
+  for(; i < size; ++i) {
+    report(i);
+  }
+  return out;
+}
+
+namespace bf_impl {
+template <typename Range>
+concept writable_storage_range =
+    storage_range<Range> &&
+    !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>;
+
+template <typename Range>
+[[nodiscard]] constexpr auto as_storage_span(Range &&storage) noexcept {
+  return std::span{std::ranges::data(storage), std::ranges::size(storage)};
+}
+} // namespace bf_impl
+
+/**
+ * Sets Dst field of every word in storage to fn(Src field of the same word)
+ *
+ * @param storage Range of storage words to update
+ * @param fn Function computing Dst value from Src value
+ */
+template <is_bitfield_spec Src, is_bitfield_spec Dst, bf_impl::writable_storage_range Range,
+          std::invocable<typename Src::value_type> Fn>
+  requires(fits_in<Src::mask, std::ranges::range_value_t<Range>> &&
+           fits_in<Dst::mask, std::ranges::range_value_t<Range>> &&
+           std::convertible_to<std::invoke_result_t<Fn &, typename Src::value_type>,
+                               typename Dst::value_type>)
+constexpr void transform_field(Range &&storage, Fn fn) {
+  for(auto &word : bf_impl::as_storage_span(storage)) {
+    as_writable_bitfield<Dst>(word) =
+        static_cast<typename Dst::value_type>(fn(as_bitfield<Src>(word).value()));
+  }
+}
+
+/**
+ * Sets Spec field of every word in storage to value
+ *
+ * @param storage Range of storage words to update
+ * @param value Value to be stored
+ */
+template <is_bitfield_spec Spec, bf_impl::writable_storage_range Range>
+  requires(fits_in<Spec::mask, std::ranges::range_value_t<Range>>)
+constexpr void fill_field(Range &&storage, typename Spec::value_type value) noexcept {
+  using storage_type = std::ranges::range_value_t<Range>;
+  constexpr auto mask = static_cast<storage_type>(Spec::mask);
+
+  storage_type bits = 0;
+  as_writable_bitfield<Spec>(bits) = value;
+  for(auto &word : bf_impl::as_storage_span(storage)) {
+    word = static_cast<storage_type>(static_cast<storage_type>(word & ~mask) | bits);
+  }
+}
+
+} // namespace ecpp
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef ECPP_BITFIELD_ATOMIC_HPP_
+#define ECPP_BITFIELD_ATOMIC_HPP_
+
+#include <ecpp/bitfield_view.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+
+namespace ecpp {
+
+namespace bf_impl {
+/// @brief Bounds of the number of polls made by wait_until() before blocking
+inline constexpr int wait_spin_min = 16;
+inline constexpr int wait_spin_max = 4096;
+
+/// @brief Current number of polls made by wait_until() on this thread. Doubled each time polling
+/// had to be repeated and succeeded, and halved each time the thread had to block
+inline thread_local int wait_spin_limit = 64;
+
+/// @brief Hints the CPU that the thread is busy waiting
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+} // namespace bf_impl
+
+/**
+ * Atomically sets Spec field of word to value and wakes up all threads waiting on word
+ *
+ * Other bits of word are preserved. The update is a read-modify-write with the given order even
+ * when the field already holds value, but waiting threads are woken up only when the field
+ * actually changed.
+ *
+ * @param word Storage shared between threads
+ * @param value Value to be stored
+ * @param order Memory order of the update
+ * @return Previous value of the field
+ */
+template <is_bitfield_spec Spec, std::unsigned_integral StorageType>
+  requires(fits_in<Spec::mask, StorageType>)
+typename Spec::value_type store_and_notify(StorageType &word, typename Spec::value_type value,
+                                           std::memory_order order = std::memory_order_seq_cst) {
+  std::atomic_ref<StorageType> ref(word);
+
+  auto current = ref.load(std::memory_order_relaxed);
+  StorageType desired;
+  do {
+    desired = current;
+    as_writable_bitfield<Spec>(desired) = value;
+  } while(!ref.compare_exchange_weak(current, desired, order, std::memory_order_relaxed));
+
+  if(desired != current) {
+    ref.notify_all();
+  }
+  return as_bitfield<Spec>(current).value();
+}
+
+/**
+ * Blocks until Spec field of word satisfies pred
+ *
+ * The field is polled with a CPU relax hint first. The number of polls adapts per thread: it grows
+ * when polling succeeds and shrinks when it does not. Afterwards, the thread blocks until word is
+ * notified (e.g. by store_and_notify()), relying on the backoff built into
+ * std::atomic_ref::wait. Wake-ups caused by changes of other bits of word are handled by
+ * re-checking pred.
+ *
+ * @param word Storage shared between threads
+ * @param pred Predicate on field value
+ * @param order Memory order of loads
+ * @return Field value that satisfied pred
+ */
+template <is_bitfield_spec Spec, std::unsigned_integral StorageType,
+          std::predicate<typename Spec::value_type> Pred>
+  requires(fits_in<Spec::mask, StorageType>)
+typename Spec::value_type wait_until(StorageType &word, Pred pred,
+                                     std::memory_order order = std::memory_order_seq_cst) {
+  using namespace bf_impl;
+  std::atomic_ref<StorageType> ref(word);
+
+  auto current = ref.load(order);
+  for(int i = 0; i < wait_spin_limit; ++i) {
+    auto field = as_bitfield<Spec>(current).value();
+    if(pred(field)) {
+      if(i != 0) {
+        wait_spin_limit = std::min(wait_spin_limit * 2, wait_spin_max);
+      }
+      return field;
+    }
+    cpu_relax();
+    current = ref.load(order);
+  }
+  wait_spin_limit = std::max(wait_spin_limit / 2, wait_spin_min);
+
+  while(true) {
+    auto field = as_bitfield<Spec>(current).value();
+    if(pred(field)) {
+      return field;
+    }
+    ref.wait(current, order);
+    current = ref.load(order);
+  }
+}
+
+/**
+ * Blocks until Spec field of word equals value. See wait_until()
+ *
+ * @param word Storage shared between threads
+ * @param value Awaited field value
+ * @param order Memory order of loads
+ */
+template <is_bitfield_spec Spec, std::unsigned_integral StorageType>
+  requires(fits_in<Spec::mask, StorageType>)
+void wait_for_value(StorageType &word, typename Spec::value_type value,
+                    std::memory_order order = std::memory_order_seq_cst) {
+  wait_until<Spec>(
+      word, [value](typename Spec::value_type v) { return v == value; }, order);
+}
+
+} // namespace ecpp
+
+#endif
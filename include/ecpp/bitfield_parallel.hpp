@@ -0,0 +1,98 @@
+#ifndef ECPP_BITFIELD_PARALLEL_HPP_
+#define ECPP_BITFIELD_PARALLEL_HPP_
+
+#include <ecpp/bitfield_algorithm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ecpp {
+
+namespace bf_impl {
+inline constexpr std::size_t cache_line_size = 64;
+
+/// @brief Minimal amount of storage worth spawning a thread for. Smaller chunks take about as long
+/// to process as creating the thread does
+inline constexpr std::size_t min_bytes_per_thread = std::size_t{1} << 20;
+inline constexpr std::size_t min_lines_per_thread = min_bytes_per_thread / cache_line_size;
+
+/**
+ * Splits storage into contiguous chunks and calls fn(chunk) for each one on a separate thread.
+ * Boundaries between chunks are aligned to cache line, so no line is written by two threads.
+ */
+template <typename T, typename Fn>
+void for_each_chunk(std::span<T> storage, unsigned concurrency, Fn fn) {
+  constexpr auto words_per_line = std::max<std::size_t>(cache_line_size / sizeof(T), 1);
+
+  auto const misalignment = reinterpret_cast<std::uintptr_t>(storage.data()) % cache_line_size;
+  auto const head =
+      std::min(storage.size(), ((cache_line_size - misalignment) % cache_line_size) / sizeof(T));
+  auto const lines = (storage.size() - head) / words_per_line;
+
+  if(concurrency == 0) {
+    concurrency = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  auto const chunks = std::clamp<std::size_t>(lines / min_lines_per_thread, 1, concurrency);
+  if(chunks == 1) {
+    fn(storage);
+    return;
+  }
+
+  auto const chunk_words = ((lines + chunks - 1) / chunks) * words_per_line;
+  std::vector<std::jthread> workers;
+  workers.reserve(chunks - 1);
+
+  auto first = std::size_t{0};
+  auto last = head + chunk_words;
+  for(std::size_t i = 1; i < chunks && last < storage.size(); ++i) {
+    workers.emplace_back([fn, chunk = storage.subspan(first, last - first)] { fn(chunk); });
+    first = last;
+    last += chunk_words;
+  }
+  fn(storage.subspan(first));
+}
+} // namespace bf_impl
+
+/**
+ * Parallel version of transform_field()
+ *
+ * Storage is split into cache line aligned chunks, processed concurrently. fn is called from
+ * multiple threads and must be noexcept.
+ *
+ * @param storage Range of storage words to update
+ * @param fn Function computing Dst value from Src value
+ * @param concurrency Maximal number of threads used. 0 means std::thread::hardware_concurrency()
+ */
+template <is_bitfield_spec Src, is_bitfield_spec Dst, bf_impl::writable_storage_range Range,
+          std::invocable<typename Src::value_type> Fn>
+  requires(fits_in<Src::mask, std::ranges::range_value_t<Range>> &&
+           fits_in<Dst::mask, std::ranges::range_value_t<Range>> &&
+           std::convertible_to<std::invoke_result_t<Fn &, typename Src::value_type>,
+                               typename Dst::value_type> &&
+           std::is_nothrow_invocable_v<Fn &, typename Src::value_type>)
+void parallel_transform(Range &&storage, Fn fn, unsigned concurrency = 0) {
+  bf_impl::for_each_chunk(bf_impl::as_storage_span(storage), concurrency,
+                          [&fn](auto chunk) { transform_field<Src, Dst>(chunk, fn); });
+}
+
+/**
+ * Parallel version of fill_field()
+ *
+ * @param storage Range of storage words to update
+ * @param value Value to be stored
+ * @param concurrency Maximal number of threads used. 0 means std::thread::hardware_concurrency()
+ */
+template <is_bitfield_spec Spec, bf_impl::writable_storage_range Range>
+  requires(fits_in<Spec::mask, std::ranges::range_value_t<Range>>)
+void parallel_fill(Range &&storage, typename Spec::value_type value, unsigned concurrency = 0) {
+  bf_impl::for_each_chunk(bf_impl::as_storage_span(storage), concurrency,
+                          [value](auto chunk) { fill_field<Spec>(chunk, value); });
+}
+
+} // namespace ecpp
+
+#endif
@@ -4,6 +4,7 @@
 #include <ecpp/bitmask.hpp>
 
 #include <cstdint>
+#include <limits>
 #include <tuple>
 namespace ecpp {
 /// @brief Concept is true, for types allowed to create bitfield from
@@ -218,7 +219,7 @@ template <typename F, typename... Fields>
 concept one_of = std::disjunction_v<std::is_same<F, Fields>...>;
 
 template <std::uintmax_t... Masks>
-concept non_overlaping = ((... & Masks) == 0);
+concept non_overlaping = ((0 + ... + std::popcount(Masks)) == std::popcount((0U | ... | Masks)));
 } // namespace bf_impl
 
 template <std::unsigned_integral StorageType, is_bitfield_spec... Fields>
@@ -0,0 +1,179 @@
+#ifndef ECPP_REGISTER_BITFIELD_HPP_
+#define ECPP_REGISTER_BITFIELD_HPP_
+
+#include <ecpp/bitfield_view.hpp>
+
+#include <cstdint>
+
+namespace ecpp {
+
+namespace bf_impl {
+/// @brief Concept is true, for constants usable as fixed storage location: an integral address, or
+/// a pointer (convertible to StorageType *) to an object with static storage duration
+template <auto Address, typename StorageType>
+concept register_address = std::integral<decltype(Address)> ||
+                           (std::is_pointer_v<decltype(Address)> &&
+                            std::convertible_to<decltype(Address), StorageType *>);
+
+template <typename StorageType, auto Address>
+[[nodiscard]] inline StorageType &register_at() noexcept {
+  if constexpr(std::is_pointer_v<decltype(Address)>) {
+    return *static_cast<StorageType *>(Address);
+  } else {
+    return *reinterpret_cast<StorageType *>(static_cast<std::uintptr_t>(Address));
+  }
+}
+} // namespace bf_impl
+
+/**
+ * Bitfield located at an address known at compile time.
+ *
+ * Unlike bitfield_view, the handle does not store a reference, so it is an empty type and every
+ * access is made directly to the fixed address. Since all the state lives in the register, all
+ * operations are const-qualified and handles can be declared constexpr.
+ */
+template <std::unsigned_integral StorageType, auto Address, is_bitfield_spec Spec>
+  requires(bf_impl::register_address<Address, StorageType> && fits_in<Spec::mask, StorageType>)
+class register_bitfield {
+  using view_type = bitfield_view<StorageType, Spec>;
+
+  [[nodiscard]] static view_type view() noexcept {
+    return view_type(bf_impl::register_at<StorageType, Address>());
+  }
+
+public:
+  using storage_type = StorageType;
+  using value_type = typename Spec::value_type; ///< Desired value type of the field
+
+  constexpr static auto mask = view_type::mask;
+
+  [[nodiscard]] value_type value() const noexcept { return view().value(); }
+
+  [[nodiscard]] operator value_type() const noexcept { return value(); }
+
+  auto const &operator=(value_type v) const noexcept
+    requires(!std::is_const_v<storage_type>)
+  {
+    view() = v;
+    return *this;
+  }
+
+  auto const &operator+=(value_type v) const noexcept
+    requires requires(view_type f) { f += v; }
+  {
+    view() += v;
+    return *this;
+  }
+
+  auto const &operator-=(value_type v) const noexcept
+    requires requires(view_type f) { f -= v; }
+  {
+    view() -= v;
+    return *this;
+  }
+
+  auto const &operator*=(value_type v) const noexcept
+    requires requires(view_type f) { f *= v; }
+  {
+    view() *= v;
+    return *this;
+  }
+
+  auto const &operator/=(value_type v) const noexcept
+    requires requires(view_type f) { f /= v; }
+  {
+    view() /= v;
+    return *this;
+  }
+
+  auto const &operator%=(value_type v) const noexcept
+    requires requires(view_type f) { f %= v; }
+  {
+    view() %= v;
+    return *this;
+  }
+
+  auto const &operator&=(value_type v) const noexcept
+    requires requires(view_type f) { f &= v; }
+  {
+    view() &= v;
+    return *this;
+  }
+
+  auto const &operator|=(value_type v) const noexcept
+    requires requires(view_type f) { f |= v; }
+  {
+    view() |= v;
+    return *this;
+  }
+
+  auto const &operator^=(value_type v) const noexcept
+    requires requires(view_type f) { f ^= v; }
+  {
+    view() ^= v;
+    return *this;
+  }
+
+  auto const &operator<<=(value_type v) const noexcept
+    requires requires(view_type f) { f <<= v; }
+  {
+    view() <<= v;
+    return *this;
+  }
+
+  auto const &operator>>=(value_type v) const noexcept
+    requires requires(view_type f) { f >>= v; }
+  {
+    view() >>= v;
+    return *this;
+  }
+
+  auto const &operator++() const noexcept
+    requires requires(view_type f) { ++f; }
+  {
+    ++view();
+    return *this;
+  }
+
+  value_type operator++(int) const noexcept
+    requires requires(view_type f) { f++; }
+  {
+    return view()++;
+  }
+
+  auto const &operator--() const noexcept
+    requires requires(view_type f) { --f; }
+  {
+    --view();
+    return *this;
+  }
+
+  value_type operator--(int) const noexcept
+    requires requires(view_type f) { f--; }
+  {
+    return view()--;
+  }
+};
+
+/// @brief Set of bitfields located at an address known at compile time. See register_bitfield
+template <std::unsigned_integral StorageType, auto Address, is_bitfield_spec... Fields>
+  requires(bf_impl::register_address<Address, StorageType> &&
+           bf_impl::non_overlaping<Fields::mask...> && fits_in<(... | Fields::mask), StorageType>)
+class register_bitfield_set {
+public:
+  using field_types = std::tuple<Fields...>;
+  using storage_type = StorageType;
+
+  constexpr static bitmask<std::remove_cv_t<storage_type>> mask{
+      static_cast<storage_type>((... | Fields::mask))};
+
+  template <typename F>
+    requires(bf_impl::one_of<F, Fields...>)
+  [[nodiscard]] constexpr auto get() const noexcept {
+    return register_bitfield<StorageType, Address, F>{};
+  }
+};
+
+} // namespace ecpp
+
+#endif
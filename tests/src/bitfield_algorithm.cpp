@@ -0,0 +1,83 @@
+#include <ecpp/bitfield_algorithm.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+using namespace ecpp;
+
+namespace {
+using state = bitfield_spec<std::uint8_t, 0x0000'000FU>;
+using counter = bitfield_spec<std::uint16_t, 0x00FF'FF00U>;
+using flag = bitfield_spec<bool, 0x8000'0000U>;
+} // namespace
+
+TEST(BitfieldAlgorithm, DiffReportsChangedFields) {
+  std::array<std::uint32_t, 4> previous{0x0000'0001U, 0x8000'0000U, 0x0012'3400U, 0x0000'0000U};
+  std::array<std::uint32_t, 4> current{0x0000'0002U, 0x8000'0000U, 0x8012'3501U, 0x0000'00F0U};
+
+  std::vector<field_change> changes;
+  diff<state, counter, flag>(previous, current, std::back_inserter(changes));
+
+  std::vector<field_change> expected{{0, 0}, {2, 0}, {2, 1}, {2, 2}};
+  EXPECT_EQ(changes, expected);
+
+  // Snapshots don't have to be of the same range type
+  std::vector<std::uint32_t> const previous_copy(previous.begin(), previous.end());
+  changes.clear();
+  diff<state, counter, flag>(previous_copy, std::span(current), std::back_inserter(changes));
+  EXPECT_EQ(changes, expected);
+}
+
+TEST(BitfieldAlgorithm, DiffSkipsUnchangedBlocks) {
+  std::vector<std::uint16_t> previous(1000, 0x1234U);
+  std::vector<std::uint16_t> current(previous);
+
+  using low = bitfield_spec<std::uint8_t, 0x00FFU>;
+  using high = bitfield_spec<std::uint8_t, 0xFF00U>;
+
+  std::vector<field_change> changes;
+  diff<low, high>(previous, current, std::back_inserter(changes));
+  EXPECT_TRUE(changes.empty());
+
+  current[31] = 0x1235U;  // last word of the first block
+  current[500] = 0x0034U; // inside a block
+  current[999] = 0x0000U; // tail, past the last full block
+  diff<low, high>(previous, current, std::back_inserter(changes));
+
+  std::vector<field_change> expected{{31, 0}, {500, 1}, {999, 0}, {999, 1}};
+  EXPECT_EQ(changes, expected);
+}
+
+TEST(BitfieldAlgorithm, DiffIgnoresBitsOutsideFields) {
+  std::vector<std::uint64_t> previous(16, 0U);
+  std::vector<std::uint64_t> current(16, 0xFFFF'FFFF'0000'0000U);
+
+  using low = bitfield_spec<std::uint32_t, 0x0000'0000'FFFF'FFFFU>;
+
+  std::vector<field_change> changes;
+  diff<low>(previous, current, std::back_inserter(changes));
+  EXPECT_TRUE(changes.empty());
+}
+
+TEST(BitfieldAlgorithm, TransformField) {
+  std::array<std::uint32_t, 3> storage{0x0000'0001U, 0x8000'0003U, 0x0012'340FU};
+
+  transform_field<state, counter>(storage,
+                                  [](std::uint8_t s) { return static_cast<std::uint16_t>(s * 2); });
+  EXPECT_EQ(storage[0], 0x0000'0201U);
+  EXPECT_EQ(storage[1], 0x8000'0603U);
+  EXPECT_EQ(storage[2], 0x0000'1E0FU);
+}
+
+TEST(BitfieldAlgorithm, FillField) {
+  std::vector<std::uint32_t> storage{0x0000'0001U, 0x8000'0003U, 0x7FFF'FFFFU};
+
+  fill_field<flag>(storage, true);
+  fill_field<state>(std::span(storage).subspan(1), 0xA);
+  EXPECT_EQ(storage[0], 0x8000'0001U);
+  EXPECT_EQ(storage[1], 0x8000'000AU);
+  EXPECT_EQ(storage[2], 0xFFFF'FFFAU);
+}
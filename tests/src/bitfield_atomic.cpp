@@ -0,0 +1,74 @@
+#include <ecpp/bitfield_atomic.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace ecpp;
+
+namespace {
+enum class state : std::uint8_t { idle, busy, ready };
+
+using state_field = bitfield_spec<state, 0x0000'0003U>;
+using counter = bitfield_spec<std::uint32_t, 0xFFFF'FF00U>;
+} // namespace
+
+TEST(BitfieldAtomic, StoreAndNotify) {
+  std::uint32_t word = 0x1234'5601U;
+
+  EXPECT_EQ(store_and_notify<state_field>(word, state::ready), state::busy);
+  EXPECT_EQ(word, 0x1234'5602U);
+
+  EXPECT_EQ(store_and_notify<state_field>(word, state::ready), state::ready);
+  EXPECT_EQ(word, 0x1234'5602U);
+
+  EXPECT_EQ(store_and_notify<counter>(word, 0xABCDU), 0x12'3456U);
+  EXPECT_EQ(word, 0x00AB'CD02U);
+}
+
+TEST(BitfieldAtomic, WaitForValue) {
+  std::uint32_t word = 0;
+
+  // Satisfied immediately
+  wait_for_value<state_field>(word, state::idle);
+
+  std::jthread producer([&word] {
+    for(std::uint32_t i = 1; i <= 1000; ++i) {
+      store_and_notify<counter>(word, i);
+    }
+    store_and_notify<state_field>(word, state::ready);
+  });
+
+  wait_for_value<state_field>(word, state::ready);
+  producer.join();
+  EXPECT_EQ(as_bitfield<counter>(word), 1000U);
+}
+
+TEST(BitfieldAtomic, WaitForValueBlocks) {
+  std::uint32_t word = 0;
+
+  // Sleeping longer than any polling makes the waiter block
+  std::jthread producer([&word] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    store_and_notify<counter>(word, 42U);
+    store_and_notify<state_field>(word, state::ready);
+  });
+
+  wait_for_value<state_field>(word, state::ready);
+  producer.join();
+  EXPECT_EQ(as_bitfield<counter>(word), 42U);
+}
+
+TEST(BitfieldAtomic, WaitUntil) {
+  std::uint32_t word = 0;
+
+  std::jthread producer([&word] {
+    for(std::uint32_t i = 1; i <= 1000; ++i) {
+      store_and_notify<counter>(word, i);
+    }
+  });
+
+  auto v = wait_until<counter>(word, [](std::uint32_t c) { return c >= 500; });
+  EXPECT_GE(v, 500U);
+}
@@ -0,0 +1,54 @@
+#include <ecpp/bitfield_parallel.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace ecpp;
+
+namespace {
+using low = bitfield_spec<std::uint16_t, 0x0000'FFFFU>;
+using high = bitfield_spec<std::uint16_t, 0xFFFF'0000U>;
+
+std::vector<std::uint32_t> make_storage(std::size_t size) {
+  std::vector<std::uint32_t> storage(size);
+  for(std::size_t i = 0; i < size; ++i) {
+    storage[i] = static_cast<std::uint32_t>(i);
+  }
+  return storage;
+}
+
+template <typename Fn>
+concept parallel_transformable =
+    requires(std::vector<std::uint32_t> &s, Fn fn) { parallel_transform<low, high>(s, fn); };
+} // namespace
+
+TEST(BitfieldParallel, Transform) {
+  auto storage = make_storage(1 << 20);
+  auto expected = storage;
+
+  auto fn = [](std::uint16_t v) noexcept { return static_cast<std::uint16_t>(v ^ 0x5A5AU); };
+  transform_field<low, high>(std::span(expected).subspan(3), fn);
+  parallel_transform<low, high>(std::span(storage).subspan(3), fn, 7);
+  EXPECT_EQ(storage, expected);
+
+  auto throwing = [](std::uint16_t v) { return v; };
+  static_assert(!parallel_transformable<decltype(throwing)>);
+  static_assert(parallel_transformable<decltype(fn)>);
+}
+
+TEST(BitfieldParallel, Fill) {
+  auto storage = make_storage(1 << 20);
+  auto expected = storage;
+
+  fill_field<high>(std::span(expected).subspan(5), 0xBEEF);
+  parallel_fill<high>(std::span(storage).subspan(5), 0xBEEF, 4);
+  EXPECT_EQ(storage, expected);
+
+  auto small = make_storage(100);
+  parallel_fill<low>(small, 0xCAFE);
+  for(auto word : small) {
+    EXPECT_EQ(as_bitfield<low>(word), 0xCAFE);
+  }
+}
@@ -79,3 +79,15 @@ TEST(BitfieldView, Factory) {
   auto vspecField = as_bitfield<f1>(v_storage);
   EXPECT_EQ(vspecField, 10);
 }
+
+TEST(BitfieldSetView, NonOverlapping) {
+  static_assert(bf_impl::non_overlaping<0x3U>);
+  static_assert(bf_impl::non_overlaping<0x3U, 0xCU, 0x30U>);
+  static_assert(!bf_impl::non_overlaping<0x3U, 0x6U, 0xCU>);
+  static_assert(!bf_impl::non_overlaping<0x3U, 0x3U>);
+
+  using f = bitfield_spec<std::uint8_t, 0xF0U>;
+  std::uint8_t storage = 0xA5;
+  auto single = as_bitfield_set<f>(storage);
+  EXPECT_EQ(single.get<f>(), 0xA);
+}
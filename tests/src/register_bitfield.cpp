@@ -0,0 +1,67 @@
+#include <ecpp/register_bitfield.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+using namespace ecpp;
+
+namespace {
+std::uint32_t peripheral = 0;
+std::uint32_t const rom = 0xFEED'FACEU;
+
+using mode = bitfield_spec<std::uint8_t, 0x0000'000FU>;
+using counter = bitfield_spec<std::int32_t, 0x00FF'FF00U>;
+using enable = bitfield_spec<bool, 0x8000'0000U>;
+} // namespace
+
+TEST(RegisterBitfield, IsEmpty) {
+  static_assert(std::is_empty_v<register_bitfield<std::uint32_t volatile, 0x4000'0000U, mode>>);
+  static_assert(
+      std::is_empty_v<register_bitfield_set<std::uint32_t volatile, 0x4000'0000U, mode, enable>>);
+}
+
+TEST(RegisterBitfield, Access) {
+  peripheral = 0x8012'3405U;
+
+  constexpr register_bitfield<std::uint32_t, &peripheral, mode> m{};
+  constexpr register_bitfield<std::uint32_t, &peripheral, counter> c{};
+  constexpr register_bitfield<std::uint32_t, &peripheral, enable> e{};
+
+  EXPECT_EQ(m, 5);
+  EXPECT_EQ(c, 0x1234);
+  EXPECT_TRUE(e);
+
+  m = 0xA;
+  e = false;
+  EXPECT_EQ(peripheral, 0x0012'340AU);
+
+  c += 1;
+  EXPECT_EQ(c++, 0x1235);
+  EXPECT_EQ(--c, 0x1235);
+  c = -1;
+  EXPECT_EQ(c, -1);
+  EXPECT_EQ(peripheral, 0x00FF'FF0AU);
+
+  constexpr register_bitfield<std::uint32_t const, &rom, counter> r{};
+  static_assert(!std::is_assignable_v<decltype(r), std::int32_t>);
+  EXPECT_EQ(r, -4614); // signed equivalent of 0xEDFA
+
+  // Volatile access to an ordinary object, as used to model memory-mapped registers
+  constexpr register_bitfield<std::uint32_t volatile, &peripheral, mode> vm{};
+  vm = 0x5;
+  EXPECT_EQ(vm, 0x5);
+  EXPECT_EQ(peripheral, 0x00FF'FF05U);
+}
+
+TEST(RegisterBitfield, Set) {
+  peripheral = 0;
+
+  constexpr register_bitfield_set<std::uint32_t, &peripheral, mode, counter, enable> regs{};
+  regs.get<mode>() = 3;
+  regs.get<enable>() = true;
+  regs.get<counter>() |= 0x42;
+
+  EXPECT_EQ(peripheral, 0x8000'4203U);
+  EXPECT_EQ(regs.get<counter>(), 0x42);
+}